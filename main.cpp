@@ -23,6 +23,24 @@
 #include <iostream>
 #include <string>
 #include <cmath>
+#include <cfloat>
+#include <random>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define BEZIER_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#endif
+
+// Compile a single function for a given instruction set without raising the baseline of the whole binary
+#if defined(__GNUC__) || defined(__clang__)
+    #define BEZIER_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define BEZIER_TARGET(isa)
+#endif
 
 #define RAYGUI_IMPLEMENTATION
 #include "extras/raygui.h"
@@ -220,6 +238,27 @@ struct cam2d : Camera2D
         cRec.height = GetScreenHeight() / zoom;
     }
 
+    // Center the view on a world-space rectangle and zoom so it fills the screen, keeping margin pixels free
+    inline void zoom_to_fit(rec bounds, float margin)
+    {
+        const float screenW = GetScreenWidth();
+        const float screenH = GetScreenHeight();
+
+        const float zoomX = (screenW - 2.0f * margin) / fmax(bounds.width, 1.0f);
+        const float zoomY = (screenH - 2.0f * margin) / fmax(bounds.height, 1.0f);
+
+        const float fitZoom = fmin(zoomX, zoomY);
+
+        // The wheel steps by 0.1 while zoom > 0, so fitting below 0.1 would let one more step flip the view.
+        // Curves wider than about 7.8k world units therefore only partly fit.
+        zoom = fmin(fmax(fitZoom, 0.1f), 3.0f);
+
+        if (fitZoom < 0.1f) { print("Zoom to fit clamped to 0.1, the curve does not fit on screen", 1); }
+
+        target = { bounds.x + bounds.width / 2.0f, bounds.y + bounds.height / 2.0f };
+        offset = { screenW / 2.0f, screenH / 2.0f };
+    }
+
     inline ::Camera2D& begin() { ::BeginMode2D(*this); return (*this); }
     inline ::Camera2D& end() { ::EndMode2D(); return (*this); }
 
@@ -240,6 +279,932 @@ inline vec2 bezier(vec2 p0, vec2 p1, vec2 p2, vec2 p3, float t)
     return vec2_lerp(d, e, t);
 }
 
+// First derivative B'(t), de Casteljau on the hodograph 3 * (p1 - p0, p2 - p1, p3 - p2)
+inline vec2 bezier_derivative(vec2 p0, vec2 p1, vec2 p2, vec2 p3, float t)
+{
+    vec2 a = vec2_lerp(p1 - p0, p2 - p1, t);
+    vec2 b = vec2_lerp(p2 - p1, p3 - p2, t);
+
+    return vec2_scale(vec2_lerp(a, b, t), 3.0f);
+}
+
+// Second derivative B''(t), linear in t
+inline vec2 bezier_second_derivative(vec2 p0, vec2 p1, vec2 p2, vec2 p3, float t)
+{
+    vec2 a = (p2 - p1) - (p1 - p0);
+    vec2 b = (p3 - p2) - (p2 - p1);
+
+    return vec2_scale(vec2_lerp(a, b, t), 6.0f);
+}
+
+// Signed curvature (x'y'' - y'x'') / |B'|^3, 0 where the derivative vanishes
+inline float bezier_curvature(vec2 p0, vec2 p1, vec2 p2, vec2 p3, float t)
+{
+    vec2 d1 = bezier_derivative(p0, p1, p2, p3, t);
+    vec2 d2 = bezier_second_derivative(p0, p1, p2, p3, t);
+
+    float speed = vec2_length(d1);
+    if (speed == 0.0f) return 0.0f;
+
+    return (d1.x * d2.y - d1.y * d2.x) / (speed * speed * speed);
+}
+
+// Real roots of a * t^2 + b * t + c, returns how many were written to roots
+inline int solve_quadratic(float a, float b, float c, float roots[2])
+{
+    if (a == 0.0f)
+    {
+        if (b == 0.0f) return 0;
+        roots[0] = -c / b;
+        return 1;
+    }
+
+    float disc = b * b - 4.0f * a * c;
+    if (disc < 0.0f) return 0;
+
+    // Avoid cancellation between -b and the square root
+    float q = -0.5f * (b + copysign(sqrt(disc), b));
+    if (q == 0.0f)
+    {
+        roots[0] = 0.0f;
+        return 1;
+    }
+
+    roots[0] = q / a;
+    roots[1] = c / q;
+    return 2;
+}
+
+// Tight axis-aligned bounds: the end points plus the curve at every root of B'(t) inside (0, 1)
+inline rec bezier_bounds(vec2 p0, vec2 p1, vec2 p2, vec2 p3)
+{
+    float minX = fmin(p0.x, p3.x), maxX = fmax(p0.x, p3.x);
+    float minY = fmin(p0.y, p3.y), maxY = fmax(p0.y, p3.y);
+
+    // B'(t) / 3 = a * t^2 + b * t + c per axis
+    vec2 a = (p3 - p0) + vec2_scale(p1 - p2, 3.0f);
+    vec2 b = vec2_scale((p0 - p1) - (p1 - p2), 2.0f);
+    vec2 c = p1 - p0;
+
+    float roots[4];
+    int count = solve_quadratic(a.x, b.x, c.x, roots);
+    count += solve_quadratic(a.y, b.y, c.y, roots + count);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (!(roots[i] > 0.0f && roots[i] < 1.0f)) continue;
+
+        vec2 p = bezier(p0, p1, p2, p3, roots[i]);
+        minX = fmin(minX, p.x); maxX = fmax(maxX, p.x);
+        minY = fmin(minY, p.y); maxY = fmax(maxY, p.y);
+    }
+
+    return { minX, minY, maxX - minX, maxY - minY };
+}
+
+// Batched forms, cp holds the four control points of one curve
+
+inline void bezier_derivative_batch(const vec2 cp[4], const float* ts, vec2* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = bezier_derivative(cp[0], cp[1], cp[2], cp[3], ts[i]);
+}
+
+inline void bezier_second_derivative_batch(const vec2 cp[4], const float* ts, vec2* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = bezier_second_derivative(cp[0], cp[1], cp[2], cp[3], ts[i]);
+}
+
+inline void bezier_curvature_batch(const vec2 cp[4], const float* ts, float* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = bezier_curvature(cp[0], cp[1], cp[2], cp[3], ts[i]);
+}
+
+// Bounds of count curves, curves[i] holds the control points of curve i
+inline void bezier_bounds_batch(const vec2 (*curves)[4], rec* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = bezier_bounds(curves[i][0], curves[i][1], curves[i][2], curves[i][3]);
+}
+
+// 2D affine transform: p' = { m00 * x + m01 * y + tx, m10 * x + m11 * y + ty }
+struct xform2d
+{
+    float m00, m01;
+    float m10, m11;
+    float tx, ty;
+};
+
+// Build a transform that rotates (in radians), scales and then translates
+inline xform2d xform2d_make(float angle, float scale, vec2 translate)
+{
+    float cosTheta = std::cos(angle) * scale;
+    float sinTheta = std::sin(angle) * scale;
+
+    return { cosTheta, -sinTheta, sinTheta, cosTheta, translate.x, translate.y };
+}
+
+// Apply a transform to a single vec2
+inline vec2 xform2d_apply(const xform2d& m, vec2 v)
+{
+    return { (m.m00 * v.x + m.m01 * v.y) + m.tx, (m.m10 * v.x + m.m11 * v.y) + m.ty };
+}
+
+/////////////////////////////////////////////////////////////////////////
+/////////////////////////////SIMD KERNELS////////////////////////////////
+
+// Evaluate the curve at count parameters ts[i], writing out[i]
+using bezier_eval_fn       = void (*)(const vec2 cp[4], const float* ts, vec2* out, int count);
+// Evaluate the curve at t = i / segments for i in [0, segments], writing segments + 1 points
+using bezier_tessellate_fn = void (*)(const vec2 cp[4], int segments, vec2* out);
+// Apply an affine transform to count points (in and out may alias)
+using xform2d_apply_fn     = void (*)(const xform2d& m, const vec2* in, vec2* out, int count);
+
+struct bezier_kernels
+{
+    const char*          name;
+    bezier_eval_fn       eval;
+    bezier_tessellate_fn tessellate;
+    xform2d_apply_fn     transform;
+};
+
+// Scalar reference, every other variant must agree with these within selfTestMaxUlp
+
+static void bezier_eval_scalar(const vec2 cp[4], const float* ts, vec2* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = bezier(cp[0], cp[1], cp[2], cp[3], ts[i]);
+}
+
+static void bezier_tessellate_scalar_from(const vec2 cp[4], int segments, vec2* out, int first)
+{
+    for (int i = first; i <= segments; i++) out[i] = bezier(cp[0], cp[1], cp[2], cp[3], (float)i / segments);
+}
+
+static void bezier_tessellate_scalar(const vec2 cp[4], int segments, vec2* out)
+{
+    bezier_tessellate_scalar_from(cp, segments, out, 0);
+}
+
+static void xform2d_apply_scalar(const xform2d& m, const vec2* in, vec2* out, int count)
+{
+    for (int i = 0; i < count; i++) out[i] = xform2d_apply(m, in[i]);
+}
+
+#ifdef BEZIER_X86
+
+/******************************SSE2*******************************/
+
+BEZIER_TARGET("sse2") static inline __m128 lerp_sse2(__m128 a, __m128 b, __m128 t)
+{
+    return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+}
+
+// Same de Casteljau steps as bezier(), for one axis of four parameters at once
+BEZIER_TARGET("sse2") static inline __m128 bezier_axis_sse2(const __m128 c[4], __m128 t)
+{
+    __m128 a = lerp_sse2(c[0], c[1], t);
+    __m128 b = lerp_sse2(c[1], c[2], t);
+    __m128 e = lerp_sse2(c[2], c[3], t);
+
+    return lerp_sse2(lerp_sse2(a, b, t), lerp_sse2(b, e, t), t);
+}
+
+// Interleave four x and four y values into four vec2
+BEZIER_TARGET("sse2") static inline void store_xy_sse2(vec2* out, __m128 x, __m128 y)
+{
+    _mm_storeu_ps(&out[0].x, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(&out[2].x, _mm_unpackhi_ps(x, y));
+}
+
+BEZIER_TARGET("sse2") static void bezier_eval_sse2(const vec2 cp[4], const float* ts, vec2* out, int count)
+{
+    __m128 cx[4], cy[4];
+    for (int k = 0; k < 4; k++) { cx[k] = _mm_set1_ps(cp[k].x); cy[k] = _mm_set1_ps(cp[k].y); }
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 t = _mm_loadu_ps(ts + i);
+        store_xy_sse2(out + i, bezier_axis_sse2(cx, t), bezier_axis_sse2(cy, t));
+    }
+
+    bezier_eval_scalar(cp, ts + i, out + i, count - i);
+}
+
+BEZIER_TARGET("sse2") static void bezier_tessellate_sse2(const vec2 cp[4], int segments, vec2* out)
+{
+    __m128 cx[4], cy[4];
+    for (int k = 0; k < 4; k++) { cx[k] = _mm_set1_ps(cp[k].x); cy[k] = _mm_set1_ps(cp[k].y); }
+
+    const __m128 iota = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 div  = _mm_set1_ps((float)segments);
+
+    int i = 0;
+    for (; i + 4 <= segments + 1; i += 4)
+    {
+        __m128 t = _mm_div_ps(_mm_add_ps(_mm_set1_ps((float)i), iota), div);
+        store_xy_sse2(out + i, bezier_axis_sse2(cx, t), bezier_axis_sse2(cy, t));
+    }
+
+    bezier_tessellate_scalar_from(cp, segments, out, i);
+}
+
+BEZIER_TARGET("sse2") static void xform2d_apply_sse2(const xform2d& m, const vec2* in, vec2* out, int count)
+{
+    // Two points per register: [x0 y0 x1 y1] * [m00 m11 ..] + [y0 x0 y1 x1] * [m01 m10 ..] + [tx ty ..]
+    const __m128 diag = _mm_setr_ps(m.m00, m.m11, m.m00, m.m11);
+    const __m128 anti = _mm_setr_ps(m.m01, m.m10, m.m01, m.m10);
+    const __m128 move = _mm_setr_ps(m.tx, m.ty, m.tx, m.ty);
+
+    int i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 v = _mm_loadu_ps(&in[i].x);
+        __m128 s = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_ps(&out[i].x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(v, diag), _mm_mul_ps(s, anti)), move));
+    }
+
+    xform2d_apply_scalar(m, in + i, out + i, count - i);
+}
+
+/****************************AVX2 + FMA***************************/
+
+BEZIER_TARGET("avx2,fma") static inline __m256 lerp_avx2(__m256 a, __m256 b, __m256 t)
+{
+    return _mm256_fmadd_ps(t, _mm256_sub_ps(b, a), a);
+}
+
+BEZIER_TARGET("avx2,fma") static inline __m256 bezier_axis_avx2(const __m256 c[4], __m256 t)
+{
+    __m256 a = lerp_avx2(c[0], c[1], t);
+    __m256 b = lerp_avx2(c[1], c[2], t);
+    __m256 e = lerp_avx2(c[2], c[3], t);
+
+    return lerp_avx2(lerp_avx2(a, b, t), lerp_avx2(b, e, t), t);
+}
+
+// unpacklo/hi work per 128-bit lane, so the halves are swapped back into order afterwards
+BEZIER_TARGET("avx2,fma") static inline void store_xy_avx2(vec2* out, __m256 x, __m256 y)
+{
+    __m256 lo = _mm256_unpacklo_ps(x, y);
+    __m256 hi = _mm256_unpackhi_ps(x, y);
+    _mm256_storeu_ps(&out[0].x, _mm256_permute2f128_ps(lo, hi, 0x20));
+    _mm256_storeu_ps(&out[4].x, _mm256_permute2f128_ps(lo, hi, 0x31));
+}
+
+BEZIER_TARGET("avx2,fma") static void bezier_eval_avx2(const vec2 cp[4], const float* ts, vec2* out, int count)
+{
+    __m256 cx[4], cy[4];
+    for (int k = 0; k < 4; k++) { cx[k] = _mm256_set1_ps(cp[k].x); cy[k] = _mm256_set1_ps(cp[k].y); }
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 t = _mm256_loadu_ps(ts + i);
+        store_xy_avx2(out + i, bezier_axis_avx2(cx, t), bezier_axis_avx2(cy, t));
+    }
+
+    bezier_eval_scalar(cp, ts + i, out + i, count - i);
+}
+
+BEZIER_TARGET("avx2,fma") static void bezier_tessellate_avx2(const vec2 cp[4], int segments, vec2* out)
+{
+    __m256 cx[4], cy[4];
+    for (int k = 0; k < 4; k++) { cx[k] = _mm256_set1_ps(cp[k].x); cy[k] = _mm256_set1_ps(cp[k].y); }
+
+    const __m256 iota = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+    const __m256 div  = _mm256_set1_ps((float)segments);
+
+    int i = 0;
+    for (; i + 8 <= segments + 1; i += 8)
+    {
+        __m256 t = _mm256_div_ps(_mm256_add_ps(_mm256_set1_ps((float)i), iota), div);
+        store_xy_avx2(out + i, bezier_axis_avx2(cx, t), bezier_axis_avx2(cy, t));
+    }
+
+    bezier_tessellate_scalar_from(cp, segments, out, i);
+}
+
+BEZIER_TARGET("avx2,fma") static void xform2d_apply_avx2(const xform2d& m, const vec2* in, vec2* out, int count)
+{
+    const __m256 diag = _mm256_setr_ps(m.m00, m.m11, m.m00, m.m11, m.m00, m.m11, m.m00, m.m11);
+    const __m256 anti = _mm256_setr_ps(m.m01, m.m10, m.m01, m.m10, m.m01, m.m10, m.m01, m.m10);
+    const __m256 move = _mm256_setr_ps(m.tx, m.ty, m.tx, m.ty, m.tx, m.ty, m.tx, m.ty);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256 v = _mm256_loadu_ps(&in[i].x);
+        __m256 s = _mm256_permute_ps(v, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm256_storeu_ps(&out[i].x, _mm256_add_ps(_mm256_fmadd_ps(s, anti, _mm256_mul_ps(v, diag)), move));
+    }
+
+    xform2d_apply_scalar(m, in + i, out + i, count - i);
+}
+
+/*****************************AVX-512*****************************/
+
+BEZIER_TARGET("avx512f") static inline __m512 lerp_avx512(__m512 a, __m512 b, __m512 t)
+{
+    return _mm512_fmadd_ps(t, _mm512_sub_ps(b, a), a);
+}
+
+BEZIER_TARGET("avx512f") static inline __m512 bezier_axis_avx512(const __m512 c[4], __m512 t)
+{
+    __m512 a = lerp_avx512(c[0], c[1], t);
+    __m512 b = lerp_avx512(c[1], c[2], t);
+    __m512 e = lerp_avx512(c[2], c[3], t);
+
+    return lerp_avx512(lerp_avx512(a, b, t), lerp_avx512(b, e, t), t);
+}
+
+// Indices >= 16 select from y, so each permute picks x[i], y[i] pairs in order
+BEZIER_TARGET("avx512f") static inline void store_xy_avx512(vec2* out, __m512 x, __m512 y)
+{
+    const __m512i lo = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hi = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    _mm512_storeu_ps(&out[0].x, _mm512_permutex2var_ps(x, lo, y));
+    _mm512_storeu_ps(&out[8].x, _mm512_permutex2var_ps(x, hi, y));
+}
+
+BEZIER_TARGET("avx512f") static void bezier_eval_avx512(const vec2 cp[4], const float* ts, vec2* out, int count)
+{
+    __m512 cx[4], cy[4];
+    for (int k = 0; k < 4; k++) { cx[k] = _mm512_set1_ps(cp[k].x); cy[k] = _mm512_set1_ps(cp[k].y); }
+
+    int i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m512 t = _mm512_loadu_ps(ts + i);
+        store_xy_avx512(out + i, bezier_axis_avx512(cx, t), bezier_axis_avx512(cy, t));
+    }
+
+    bezier_eval_scalar(cp, ts + i, out + i, count - i);
+}
+
+BEZIER_TARGET("avx512f") static void bezier_tessellate_avx512(const vec2 cp[4], int segments, vec2* out)
+{
+    __m512 cx[4], cy[4];
+    for (int k = 0; k < 4; k++) { cx[k] = _mm512_set1_ps(cp[k].x); cy[k] = _mm512_set1_ps(cp[k].y); }
+
+    const __m512 iota = _mm512_setr_ps(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512 div  = _mm512_set1_ps((float)segments);
+
+    int i = 0;
+    for (; i + 16 <= segments + 1; i += 16)
+    {
+        __m512 t = _mm512_div_ps(_mm512_add_ps(_mm512_set1_ps((float)i), iota), div);
+        store_xy_avx512(out + i, bezier_axis_avx512(cx, t), bezier_axis_avx512(cy, t));
+    }
+
+    bezier_tessellate_scalar_from(cp, segments, out, i);
+}
+
+BEZIER_TARGET("avx512f") static void xform2d_apply_avx512(const xform2d& m, const vec2* in, vec2* out, int count)
+{
+    const __m512 diag = _mm512_setr_ps(m.m00, m.m11, m.m00, m.m11, m.m00, m.m11, m.m00, m.m11,
+                                       m.m00, m.m11, m.m00, m.m11, m.m00, m.m11, m.m00, m.m11);
+    const __m512 anti = _mm512_setr_ps(m.m01, m.m10, m.m01, m.m10, m.m01, m.m10, m.m01, m.m10,
+                                       m.m01, m.m10, m.m01, m.m10, m.m01, m.m10, m.m01, m.m10);
+    const __m512 move = _mm512_setr_ps(m.tx, m.ty, m.tx, m.ty, m.tx, m.ty, m.tx, m.ty,
+                                       m.tx, m.ty, m.tx, m.ty, m.tx, m.ty, m.tx, m.ty);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m512 v = _mm512_loadu_ps(&in[i].x);
+        __m512 s = _mm512_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm512_storeu_ps(&out[i].x, _mm512_add_ps(_mm512_fmadd_ps(s, anti, _mm512_mul_ps(v, diag)), move));
+    }
+
+    xform2d_apply_scalar(m, in + i, out + i, count - i);
+}
+
+#endif // BEZIER_X86
+
+/////////////////////////////////////////////////////////////////////////
+/////////////////////////////CPU DISPATCH////////////////////////////////
+
+struct cpu_features
+{
+    bool sse2    = 0;
+    bool avx2    = 0;
+    bool fma     = 0;
+    bool avx512f = 0;
+};
+
+// Query the CPU (and the OS, for the wider register state) once at startup
+static cpu_features detect_cpu_features()
+{
+    cpu_features f;
+
+#if defined(BEZIER_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    f.sse2    = __builtin_cpu_supports("sse2");
+    f.avx2    = __builtin_cpu_supports("avx2");
+    f.fma     = __builtin_cpu_supports("fma");
+    f.avx512f = __builtin_cpu_supports("avx512f");
+#elif defined(BEZIER_X86) && defined(_MSC_VER)
+    int r[4];
+    __cpuid(r, 0);
+    const int maxLeaf = r[0];
+
+    __cpuid(r, 1);
+    f.sse2 = (r[3] >> 26) & 1;
+    f.fma  = (r[2] >> 12) & 1;
+
+    const bool osxsave = (r[2] >> 27) & 1;
+    const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    const bool osAvx    = (xcr0 & 0x06) == 0x06; // XMM and YMM state
+    const bool osAvx512 = (xcr0 & 0xE6) == 0xE6; // plus opmask and ZMM state
+
+    if (maxLeaf >= 7)
+    {
+        __cpuidex(r, 7, 0);
+        f.avx2    = osAvx && ((r[1] >> 5) & 1);
+        f.avx512f = osAvx512 && ((r[1] >> 16) & 1);
+    }
+    f.fma = f.fma && osAvx;
+#endif
+
+    return f;
+}
+
+static const bezier_kernels kernelsScalar = { "scalar", bezier_eval_scalar, bezier_tessellate_scalar, xform2d_apply_scalar };
+#ifdef BEZIER_X86
+static const bezier_kernels kernelsSse2   = { "sse2",   bezier_eval_sse2,   bezier_tessellate_sse2,   xform2d_apply_sse2   };
+static const bezier_kernels kernelsAvx2   = { "avx2",   bezier_eval_avx2,   bezier_tessellate_avx2,   xform2d_apply_avx2   };
+static const bezier_kernels kernelsAvx512 = { "avx512", bezier_eval_avx512, bezier_tessellate_avx512, xform2d_apply_avx512 };
+#endif
+
+// Kernels the running CPU can execute, ordered from slowest to fastest
+static vector<const bezier_kernels*> supported_kernels(const cpu_features& f)
+{
+    vector<const bezier_kernels*> list = { &kernelsScalar };
+
+#ifdef BEZIER_X86
+    if (f.sse2) list.push_back(&kernelsSse2);
+    if (f.avx2 && f.fma) list.push_back(&kernelsAvx2);
+    if (f.avx512f) list.push_back(&kernelsAvx512);
+#endif
+
+    return list;
+}
+
+// Pick the fastest supported variant, or the one named by forced if it is supported
+static const bezier_kernels* select_kernels(const cpu_features& f, const str& forced)
+{
+    vector<const bezier_kernels*> list = supported_kernels(f);
+
+    for (auto kernels : list)
+    {
+        if (forced == kernels->name) return kernels;
+    }
+    if (!forced.empty()) { print("Requested kernels \"" + forced + "\" not supported, using " + list.back()->name, 1); }
+
+    return list.back();
+}
+
+static const bezier_kernels* activeKernels = &kernelsScalar;
+
+/////////////////////////////////////////////////////////////////////////
+/////////////////////////////CACHED CURVE////////////////////////////////
+
+// A cubic Bézier curve that keeps its bounds and tessellation until the control points change
+struct bezier_curve
+{
+    // Returns true and drops every cached result if any control point moved
+    inline bool set_points(vec2 p0, vec2 p1, vec2 p2, vec2 p3)
+    {
+        const vec2 next[4] = { p0, p1, p2, p3 };
+
+        bool isChanged = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            if (cp[i].x != next[i].x || cp[i].y != next[i].y) isChanged = 1;
+            cp[i] = next[i];
+        }
+
+        if (isChanged)
+        {
+            isBoundsValid = 0;
+            tessSegments  = -1;
+        }
+
+        return isChanged;
+    }
+
+    inline vec2  eval(float t)              const { return bezier(cp[0], cp[1], cp[2], cp[3], t); }
+    inline vec2  derivative(float t)        const { return bezier_derivative(cp[0], cp[1], cp[2], cp[3], t); }
+    inline vec2  second_derivative(float t) const { return bezier_second_derivative(cp[0], cp[1], cp[2], cp[3], t); }
+    inline float curvature(float t)         const { return bezier_curvature(cp[0], cp[1], cp[2], cp[3], t); }
+
+    inline void derivative(const float* ts, vec2* out, int count)        const { bezier_derivative_batch(cp, ts, out, count); }
+    inline void second_derivative(const float* ts, vec2* out, int count) const { bezier_second_derivative_batch(cp, ts, out, count); }
+    inline void curvature(const float* ts, float* out, int count)        const { bezier_curvature_batch(cp, ts, out, count); }
+
+    inline const rec& bounds()
+    {
+        if (!isBoundsValid)
+        {
+            cachedBounds  = bezier_bounds(cp[0], cp[1], cp[2], cp[3]);
+            isBoundsValid = 1;
+        }
+
+        return cachedBounds;
+    }
+
+    // segments + 1 points along the curve, evaluated with the active SIMD kernels
+    inline const vec2* tessellate(int segments)
+    {
+        if (tessSegments != segments)
+        {
+            cachedTess.resize(segments + 1);
+            activeKernels->tessellate(cp, segments, cachedTess.data());
+            tessSegments = segments;
+        }
+
+        return cachedTess.data();
+    }
+
+    // Read-only, set_points() is the only way to move them so the cache can never go stale
+    inline const vec2* points() const { return cp; }
+
+private:
+    vec2 cp[4] = {};
+
+    rec  cachedBounds  = {};
+    bool isBoundsValid = 0;
+
+    vector<vec2> cachedTess;
+    int          tessSegments = -1;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///////////////////////////////SELF TEST/////////////////////////////////
+
+// Allowed distance from the scalar reference, in ULPs of the magnitude of the inputs.
+// The FMA variants round differently from bezier(), so they cannot be held to 0.
+const float selfTestMaxUlp = 8.0f;
+
+// Distance between a and b in units in the last place of scale
+static float ulp_error(float a, float b, float scale)
+{
+    float ulp = std::nextafter(scale, INFINITY) - scale;
+    if (ulp < FLT_TRUE_MIN) ulp = FLT_TRUE_MIN;
+
+    return std::fabs(a - b) / ulp;
+}
+
+// Scalar tessellation that counts how often bezier_curve rebuilds its cache
+static int tessellateCalls = 0;
+
+static void bezier_tessellate_counting(const vec2 cp[4], int segments, vec2* out)
+{
+    tessellateCalls++;
+    bezier_tessellate_scalar(cp, segments, out);
+}
+
+static const bezier_kernels kernelsCounting = { "counting", bezier_eval_scalar, bezier_tessellate_counting, xform2d_apply_scalar };
+
+static bool same_rec(const rec& a, const rec& b)
+{
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+// True if tess holds exactly the scalar tessellation of cp with the given segment count
+static bool same_tessellation(const vec2 cp[4], int segments, const vec2* tess)
+{
+    vector<vec2> ref(segments + 1);
+    bezier_tessellate_scalar(cp, segments, ref.data());
+
+    for (int i = 0; i <= segments; i++)
+    {
+        if (tess[i].x != ref[i].x || tess[i].y != ref[i].y) return 0;
+    }
+
+    return 1;
+}
+
+// Check that dense samples of a curve lie inside its bounds (in ULPs of scale) and that no edge is
+// further out than the sampling step explains (as a fraction of scale)
+static void check_bounds(const vec2 cp[4], float scale, float& maxOutside, float& maxSlack)
+{
+    const rec box = bezier_bounds(cp[0], cp[1], cp[2], cp[3]);
+    float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+
+    const int samples = 4096;
+    vector<vec2> tess(samples + 1);
+    bezier_tessellate_scalar(cp, samples, tess.data());
+
+    for (const vec2& p : tess)
+    {
+        minX = fmin(minX, p.x); maxX = fmax(maxX, p.x);
+        minY = fmin(minY, p.y); maxY = fmax(maxY, p.y);
+    }
+
+    maxOutside = fmax(maxOutside, ulp_error(fmin(minX, box.x), box.x, scale));
+    maxOutside = fmax(maxOutside, ulp_error(fmin(minY, box.y), box.y, scale));
+    maxOutside = fmax(maxOutside, ulp_error(fmax(maxX, box.x + box.width), box.x + box.width, scale));
+    maxOutside = fmax(maxOutside, ulp_error(fmax(maxY, box.y + box.height), box.y + box.height, scale));
+
+    maxSlack = fmax(maxSlack, (minX - box.x) / scale);
+    maxSlack = fmax(maxSlack, (minY - box.y) / scale);
+    maxSlack = fmax(maxSlack, (box.x + box.width - maxX) / scale);
+    maxSlack = fmax(maxSlack, (box.y + box.height - maxY) / scale);
+}
+
+// Cross-check every supported kernel variant against the scalar reference, then check the derivative,
+// curvature and bounds queries (and their batched forms). Returns the number of failures.
+static int run_self_test(const cpu_features& f)
+{
+    mt19937 rng(20240101u);
+    uniform_real_distribution<float> unit(0.0f, 1.0f);
+    uniform_real_distribution<float> coord(-worldWidth / 2.0f, worldWidth / 2.0f);
+
+    // Odd sizes exercise the scalar tails of every vector width
+    const int counts[] = { 0, 1, 3, 7, 15, 17, 31, 33, 100, 1037 };
+    const int trials = 64;
+
+    int failures = 0;
+
+    for (auto kernels : supported_kernels(f))
+    {
+        float maxEval = 0.0f, maxTess = 0.0f, maxXform = 0.0f;
+
+        for (int trial = 0; trial < trials; trial++)
+        {
+            // Vary the magnitude so both tiny and world-sized curves are covered
+            const float range = std::ldexp(1.0f, trial % 16 - 4);
+            vec2 cp[4];
+            float scale = 0.0f;
+            for (auto& p : cp)
+            {
+                p = vec2_scale({ coord(rng), coord(rng) }, range);
+                scale = fmax(scale, fmax(std::fabs(p.x), std::fabs(p.y)));
+            }
+
+            const xform2d m = xform2d_make(unit(rng) * 6.2831853f, 0.5f + unit(rng) * 2.0f, { coord(rng), coord(rng) });
+
+            for (int count : counts)
+            {
+                vector<float> ts(count);
+                for (int i = 0; i < count; i++) ts[i] = unit(rng);
+                if (count > 1) { ts[0] = 0.0f; ts[count - 1] = 1.0f; }
+
+                vector<vec2> got(count), want(count);
+
+                kernels->eval(cp, ts.data(), got.data(), count);
+                for (int i = 0; i < count; i++)
+                {
+                    want[i] = bezier(cp[0], cp[1], cp[2], cp[3], ts[i]);
+                    maxEval = fmax(maxEval, ulp_error(got[i].x, want[i].x, scale));
+                    maxEval = fmax(maxEval, ulp_error(got[i].y, want[i].y, scale));
+                    if (got[i].x != got[i].x || got[i].y != got[i].y) maxEval = INFINITY;
+                }
+
+                if (count > 0)
+                {
+                    vector<vec2> tess(count + 1);
+                    kernels->tessellate(cp, count, tess.data());
+                    for (int i = 0; i <= count; i++)
+                    {
+                        vec2 ref = bezier(cp[0], cp[1], cp[2], cp[3], (float)i / count);
+                        maxTess = fmax(maxTess, ulp_error(tess[i].x, ref.x, scale));
+                        maxTess = fmax(maxTess, ulp_error(tess[i].y, ref.y, scale));
+                        if (tess[i].x != tess[i].x || tess[i].y != tess[i].y) maxTess = INFINITY;
+                    }
+                }
+
+                kernels->transform(m, want.data(), got.data(), count);
+                for (int i = 0; i < count; i++)
+                {
+                    vec2 ref = xform2d_apply(m, want[i]);
+                    float sx = std::fabs(m.m00 * want[i].x) + std::fabs(m.m01 * want[i].y) + std::fabs(m.tx);
+                    float sy = std::fabs(m.m10 * want[i].x) + std::fabs(m.m11 * want[i].y) + std::fabs(m.ty);
+                    maxXform = fmax(maxXform, ulp_error(got[i].x, ref.x, sx));
+                    maxXform = fmax(maxXform, ulp_error(got[i].y, ref.y, sy));
+                    if (got[i].x != got[i].x || got[i].y != got[i].y) maxXform = INFINITY;
+                }
+            }
+        }
+
+        const bool pass = maxEval <= selfTestMaxUlp && maxTess <= selfTestMaxUlp && maxXform <= selfTestMaxUlp;
+        if (!pass) failures++;
+
+        print(str(pass ? "[PASS] " : "[FAIL] ") + kernels->name +
+              "  eval: "      + to_string(maxEval)  +
+              "  tessellate: " + to_string(maxTess)  +
+              "  transform: "  + to_string(maxXform) + " ulp", 1);
+    }
+
+    // Derivatives against the power basis B'(t) = 3 * (a * t^2 + b * t + c), B''(t) = 3 * (2 * a * t + b),
+    // measured in ULPs of a bound on the terms (|p_i| <= scale gives |a| <= 8 scale, |b| <= 8 scale, |c| <= 2 scale)
+    float maxD1 = 0.0f, maxD2 = 0.0f;
+    bool isBatchExact = 1;
+
+    for (int trial = 0; trial < trials; trial++)
+    {
+        const float range = std::ldexp(1.0f, trial % 16 - 4);
+        vec2 cp[4];
+        float scale = 0.0f;
+        for (auto& p : cp)
+        {
+            p = vec2_scale({ coord(rng), coord(rng) }, range);
+            scale = fmax(scale, fmax(std::fabs(p.x), std::fabs(p.y)));
+        }
+
+        vec2 a = (cp[3] - cp[0]) + vec2_scale(cp[1] - cp[2], 3.0f);
+        vec2 b = vec2_scale((cp[0] - cp[1]) - (cp[1] - cp[2]), 2.0f);
+        vec2 c = cp[1] - cp[0];
+
+        const int count = 257;
+        vector<float> ts(count);
+        for (int i = 0; i < count; i++) ts[i] = (float)i / (count - 1);
+
+        vector<vec2>  d1(count), d2(count);
+        vector<float> k(count);
+        bezier_derivative_batch(cp, ts.data(), d1.data(), count);
+        bezier_second_derivative_batch(cp, ts.data(), d2.data(), count);
+        bezier_curvature_batch(cp, ts.data(), k.data(), count);
+
+        for (int i = 0; i < count; i++)
+        {
+            const float t = ts[i];
+
+            vec2 refD1 = vec2_scale(vec2_scale(a, t * t) + vec2_scale(b, t) + c, 3.0f);
+            vec2 refD2 = vec2_scale(vec2_scale(a, 2.0f * t) + b, 3.0f);
+
+            vec2 gotD1 = bezier_derivative(cp[0], cp[1], cp[2], cp[3], t);
+            vec2 gotD2 = bezier_second_derivative(cp[0], cp[1], cp[2], cp[3], t);
+
+            maxD1 = fmax(maxD1, ulp_error(gotD1.x, refD1.x, 54.0f * scale));
+            maxD1 = fmax(maxD1, ulp_error(gotD1.y, refD1.y, 54.0f * scale));
+            maxD2 = fmax(maxD2, ulp_error(gotD2.x, refD2.x, 72.0f * scale));
+            maxD2 = fmax(maxD2, ulp_error(gotD2.y, refD2.y, 72.0f * scale));
+
+            // Batched forms are the same arithmetic, so they must match bit for bit
+            const float gotK = bezier_curvature(cp[0], cp[1], cp[2], cp[3], t);
+            if (d1[i].x != gotD1.x || d1[i].y != gotD1.y) isBatchExact = 0;
+            if (d2[i].x != gotD2.x || d2[i].y != gotD2.y) isBatchExact = 0;
+            if (k[i] != gotK && !(k[i] != k[i] && gotK != gotK)) isBatchExact = 0;
+        }
+    }
+
+    const bool derivativePass = maxD1 <= selfTestMaxUlp && maxD2 <= selfTestMaxUlp;
+    if (!derivativePass) failures++;
+
+    print(str(derivativePass ? "[PASS] " : "[FAIL] ") + "derivative: " + to_string(maxD1) +
+          "  second derivative: " + to_string(maxD2) + " ulp", 1);
+
+    // The standard four-point quarter circle approximation has curvature within 2.5% of 1 / r (its radius
+    // is within 0.03%), positive counter-clockwise and negative when mirrored. A straight line has none.
+    float maxArc = 0.0f, maxLine = 0.0f;
+
+    const float radii[] = { 0.5f, 20.0f, 300.0f, 5000.0f };
+    for (float r : radii)
+    {
+        const float h = 0.55228475f * r;
+        const vec2 ccw[4] = { { r, 0.0f }, { r, h }, { h, r }, { 0.0f, r } };
+        const vec2 cw[4]  = { { r, 0.0f }, { r, -h }, { h, -r }, { 0.0f, -r } };
+        const vec2 line[4] = { { -r, -r }, { 0.0f, 0.0f }, { r, r }, { 3.0f * r, 3.0f * r } };
+
+        for (int i = 0; i <= 64; i++)
+        {
+            const float t = i / 64.0f;
+            maxArc  = fmax(maxArc, std::fabs(bezier_curvature(ccw[0], ccw[1], ccw[2], ccw[3], t) * r - 1.0f));
+            maxArc  = fmax(maxArc, std::fabs(bezier_curvature(cw[0], cw[1], cw[2], cw[3], t) * r + 1.0f));
+            maxLine = fmax(maxLine, std::fabs(bezier_curvature(line[0], line[1], line[2], line[3], t) * r));
+        }
+    }
+
+    const bool curvaturePass = maxArc <= 2.5e-2f && maxLine <= 1e-6f;
+    if (!curvaturePass) failures++;
+
+    print(str(curvaturePass ? "[PASS] " : "[FAIL] ") + "curvature  arc: " + to_string(maxArc) +
+          "  line: " + to_string(maxLine) + " relative to 1 / r", 1);
+
+    // Tight bounds: fixed degenerate curves first, then random ones
+    float maxOutside = 0.0f, maxSlack = 0.0f;
+
+    const vec2 degenerate[][4] =
+    {
+        { { 5.0f, 7.0f }, { 5.0f, 7.0f }, { 5.0f, 7.0f }, { 5.0f, 7.0f } },             // a single point
+        { { 0.0f, 0.0f }, { 40.0f, 20.0f }, { -20.0f, -10.0f }, { 20.0f, 10.0f } },     // collinear, overshooting both ends
+        { { 0.0f, 0.0f }, { 20.0f, 40.0f }, { 50.0f, 40.0f }, { 90.0f, 0.0f } },        // elevated quadratic, a == 0
+        { { 0.0f, 0.0f }, { 100.0f, 100.0f }, { 0.0f, 100.0f }, { 100.0f, 0.0f } },     // cusp at t = 0.5, double root
+        { { 10.0f, 10.0f }, { 10.0f, 10.0f }, { 10.0f, 10.0f }, { 60.0f, -30.0f } },    // b == c == 0, q == 0
+    };
+    const int degenerateCount = sizeof(degenerate) / sizeof(degenerate[0]);
+
+    for (const auto& cp : degenerate)
+    {
+        float scale = 1.0f;
+        for (const vec2& p : cp) scale = fmax(scale, fmax(std::fabs(p.x), std::fabs(p.y)));
+
+        check_bounds(cp, scale, maxOutside, maxSlack);
+    }
+
+    // Known exact boxes for the point and the elevated quadratic (whose peak is y = 30 at t = 0.5)
+    const rec pointBox = bezier_bounds(degenerate[0][0], degenerate[0][1], degenerate[0][2], degenerate[0][3]);
+    const rec quadBox  = bezier_bounds(degenerate[2][0], degenerate[2][1], degenerate[2][2], degenerate[2][3]);
+    const bool isExactBoxes =
+        pointBox.x == 5.0f && pointBox.y == 7.0f && pointBox.width == 0.0f && pointBox.height == 0.0f &&
+        quadBox.x  == 0.0f && quadBox.y  == 0.0f && quadBox.width  == 90.0f && quadBox.height == 30.0f;
+
+    // The q == 0 root is always t = 0, which the end points already cover, so check the solver directly
+    float roots[2] = {};
+    const bool isExactRoots =
+        solve_quadratic(0.0f, 20.0f, 20.0f, roots) == 1 && roots[0] == -1.0f &&      // linear, a == 0
+        solve_quadratic(1.0f, 0.0f, 0.0f, roots) == 1 && roots[0] == 0.0f &&         // q == 0
+        solve_quadratic(4.0f, -4.0f, 1.0f, roots) == 2 && roots[0] == 0.5f && roots[1] == 0.5f &&
+        solve_quadratic(1.0f, 0.0f, 1.0f, roots) == 0 &&                              // no real roots
+        solve_quadratic(0.0f, 0.0f, 3.0f, roots) == 0;                                // constant
+
+    rec batchBoxes[degenerateCount];
+    bezier_bounds_batch(degenerate, batchBoxes, degenerateCount);
+    for (int i = 0; i < degenerateCount; i++)
+    {
+        const rec box = bezier_bounds(degenerate[i][0], degenerate[i][1], degenerate[i][2], degenerate[i][3]);
+        if (batchBoxes[i].x != box.x || batchBoxes[i].y != box.y ||
+            batchBoxes[i].width != box.width || batchBoxes[i].height != box.height) isBatchExact = 0;
+    }
+
+    for (int trial = 0; trial < trials; trial++)
+    {
+        const float range = std::ldexp(1.0f, trial % 16 - 4);
+        vec2 cp[4];
+        float scale = 0.0f;
+        for (auto& p : cp)
+        {
+            p = vec2_scale({ coord(rng), coord(rng) }, range);
+            scale = fmax(scale, fmax(std::fabs(p.x), std::fabs(p.y)));
+        }
+
+        check_bounds(cp, scale, maxOutside, maxSlack);
+    }
+
+    // Near an extremum a sample step of 1/4096 can miss at most ~|B''| / 2 * step^2, about 2e-6 of the scale
+    const bool boundsPass = maxOutside <= selfTestMaxUlp && maxSlack <= 1e-5f && isExactBoxes && isExactRoots;
+    if (!boundsPass) failures++;
+
+    print(str(boundsPass ? "[PASS] " : "[FAIL] ") + "bounds  outside: " + to_string(maxOutside) +
+          " ulp  slack: " + to_string(maxSlack) + " of scale" +
+          (isExactBoxes ? "" : "  (degenerate box mismatch)") + (isExactRoots ? "" : "  (quadratic root mismatch)"), 1);
+
+    if (!isBatchExact) failures++;
+
+    print(str(isBatchExact ? "[PASS] " : "[FAIL] ") + "batch queries match single queries", 1);
+
+    // bezier_curve keeps bounds and tessellation until set_points() actually moves a point
+    const bezier_kernels* savedKernels = activeKernels;
+    activeKernels = &kernelsCounting;
+
+    bool isCachePass = 1;
+    const int segments = 37;
+
+    for (int trial = 0; trial < trials; trial++)
+    {
+        const float range = std::ldexp(1.0f, trial % 16 - 4);
+        vec2 cp[4];
+        for (auto& p : cp) p = vec2_scale({ coord(rng), coord(rng) }, range);
+
+        bezier_curve curve;
+        tessellateCalls = 0;
+
+        if (!curve.set_points(cp[0], cp[1], cp[2], cp[3])) isCachePass = 0;
+
+        const rec box = curve.bounds();
+        curve.tessellate(segments);
+        if (!same_rec(box, bezier_bounds(cp[0], cp[1], cp[2], cp[3]))) isCachePass = 0;
+
+        // Same points: nothing is dropped or rebuilt
+        if (curve.set_points(cp[0], cp[1], cp[2], cp[3])) isCachePass = 0;
+        if (!same_rec(curve.bounds(), box)) isCachePass = 0;
+        if (!same_tessellation(cp, segments, curve.tessellate(segments))) isCachePass = 0;
+        if (tessellateCalls != 1) isCachePass = 0;
+
+        // One point moved: bounds and tessellation follow the new points
+        cp[trial % 4] = cp[trial % 4] + vec2_scale({ 1.0f, -1.0f }, range);
+
+        if (!curve.set_points(cp[0], cp[1], cp[2], cp[3])) isCachePass = 0;
+        if (!same_rec(curve.bounds(), bezier_bounds(cp[0], cp[1], cp[2], cp[3]))) isCachePass = 0;
+        if (!same_tessellation(cp, segments, curve.tessellate(segments))) isCachePass = 0;
+        if (tessellateCalls != 2) isCachePass = 0;
+
+        // A different segment count is rebuilt, asking again for it is not
+        if (!same_tessellation(cp, segments + 5, curve.tessellate(segments + 5))) isCachePass = 0;
+        curve.tessellate(segments + 5);
+        if (tessellateCalls != 3) isCachePass = 0;
+    }
+
+    activeKernels = savedKernels;
+
+    if (!isCachePass) failures++;
+
+    print(str(isCachePass ? "[PASS] " : "[FAIL] ") + "curve cache follows the control points", 1);
+
+    return failures;
+}
+
 /////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////                                                                                
 
@@ -288,8 +1253,28 @@ static bool gui_draw_check_box(const char* text, vec2 pos, int size, gui_check_b
 /////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////// 
 
-int main()
+int main(int argc, char** argv)
 {
+    // --self-test        cross-check every supported kernel variant against bezier() and exit
+    // --kernels=<name>   force a kernel variant (scalar, sse2, avx2, avx512) instead of the fastest one
+    bool isSelfTest = 0;
+    str forcedKernels;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const str arg = argv[i];
+
+        if (arg == "--self-test") isSelfTest = 1;
+        else if (arg.rfind("--kernels=", 0) == 0) forcedKernels = arg.substr(10);
+    }
+
+    const cpu_features cpu = detect_cpu_features();
+
+    if (isSelfTest) return run_self_test(cpu) == 0 ? 0 : 1;
+
+    activeKernels = select_kernels(cpu, forcedKernels);
+    print("SIMD kernels: " + str(activeKernels->name), 1);
+
     int screenWidth = 940;
     int screenHeight = 720;
 
@@ -308,7 +1293,7 @@ int main()
 
     float t = 0.0f; // Initialize t to 0.0f
 
-    const vec2& posP0 = p0.pos;
+    bezier_curve curve;
 
     cam2d cam;
 
@@ -374,6 +1359,8 @@ int main()
 
     for (int i = 0; i < 4; i++) points[i]->id = i;
 
+    const int curveSegments = 100;
+
     bool manualMode = 0;
 
     while (!WindowShouldClose())
@@ -467,15 +1454,20 @@ int main()
             }
         }
 
+        curve.set_points(p0.pos, p1.pos, p2.pos, p3.pos);
+
         // Use Bezier function to interpolate between control points
-        vec2 newPos = bezier(p0.pos, p1.pos, p2.pos, p3.pos, t);
+        vec2 newPos = curve.eval(t);
 
         // Update the object's position with the new calculated position
         ball.pos = newPos;
 
-        vec2 a = vec2_lerp(p0.pos, p1.pos, t);
-        vec2 b = vec2_lerp(p1.pos, p2.pos, t);
-        vec2 c = vec2_lerp(p2.pos, p3.pos, t);      
+        // Construction lines from the same control points the curve was evaluated with
+        const vec2* cp = curve.points();
+
+        vec2 a = vec2_lerp(cp[0], cp[1], t);
+        vec2 b = vec2_lerp(cp[1], cp[2], t);
+        vec2 c = vec2_lerp(cp[2], cp[3], t);      
         vec2 d = vec2_lerp(a, b, t);
         vec2 e = vec2_lerp(b, c, t);
 
@@ -537,13 +1529,8 @@ int main()
             DrawLine(points[i]->pos.x, points[i]->pos.y, points[nextIndex]->pos.x, points[nextIndex]->pos.y, GREEN);
         }
 
-        for (float t = 0.0f; t <= 1.0f; t += 0.01f) 
-        {
-            vec2 point1 = bezier(p0.pos, p1.pos, p2.pos, p3.pos, t);
-            t += 0.01f;
-            vec2 point2 = bezier(p0.pos, p1.pos, p2.pos, p3.pos, t);
-            DrawLineV(point1, point2, BLACK);
-        }
+        // Older raylib declares DrawLineStrip(Vector2*, ...) although it only reads the points
+        DrawLineStrip(const_cast<vec2*>(curve.tessellate(curveSegments)), curveSegments + 1, BLACK);
 
         str ballPos = "x: " + to_string((int)ball.pos.x) + " y: " + to_string((int)ball.pos.x);
         DrawText(ballPos.c_str(), ball.pos.x - 30, ball.pos.y - 40, 14, BLACK);
@@ -599,6 +1586,11 @@ int main()
             DrawRectangleRec(get_rec_x2(cam.cRec), RED);
             DrawRectangleRec(get_rec_y1(cam.cRec), RED);
             DrawRectangleRec(get_rec_y2(cam.cRec), RED);
+
+            DrawRectangleLinesEx(curve.bounds(), 2, ORANGE);
+
+            str curvature = "k: " + to_string(curve.curvature(t));
+            DrawText(curvature.c_str(), ball.pos.x - 30, ball.pos.y + 25, 14, BLACK);
         }
 
         cam.end();
@@ -655,14 +1647,8 @@ int main()
 
         if (isResetCamera)
         {
-            cam.zoom = 1.0f;
-            cam.target = posP0;
-            cam.offset = 
-            { 
-              GetScreenWidth() / 2.0f, 
-              GetScreenHeight() / 2.0f 
-            };
-            cam.zoom = 1.0f;
+            curve.set_points(p0.pos, p1.pos, p2.pos, p3.pos);
+            cam.zoom_to_fit(curve.bounds(), 80.0f);
         }
 
         DrawFPS(GetScreenWidth() - 100, 10);